@@ -0,0 +1,96 @@
+#pragma once
+#include "rng_platform.h"
+#include "rng_splitmix64.h"
+#include "rng_xoroshiro128pp.h"
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <memory>
+
+// Ways of sharing one generator between threads, for the --contention mode.
+// Every type is constructed from a seed and exposes a thread-safe next_u64().
+
+struct SpinLock {
+  std::atomic<bool> locked{false};
+  inline void lock() {
+    for (;;) {
+      if (!locked.exchange(true, std::memory_order_acquire)) return;
+      while (locked.load(std::memory_order_relaxed)) cpu_relax();
+    }
+  }
+  inline void unlock() { locked.store(false, std::memory_order_release); }
+};
+
+// One xoroshiro128++ behind a std::mutex.
+struct shared_mutex_xoroshiro {
+  std::mutex mtx;
+  xoroshiro128pp gen;
+  explicit shared_mutex_xoroshiro(uint64_t seed) : gen(seed) {}
+  inline uint64_t next_u64() {
+    std::lock_guard<std::mutex> lk(mtx);
+    return gen.next_u64();
+  }
+};
+
+// One xoroshiro128++ behind a test-and-test-and-set spinlock.
+struct shared_spin_xoroshiro {
+  SpinLock lk;
+  xoroshiro128pp gen;
+  explicit shared_spin_xoroshiro(uint64_t seed) : gen(seed) {}
+  inline uint64_t next_u64() {
+    std::lock_guard<SpinLock> g(lk);
+    return gen.next_u64();
+  }
+};
+
+// Lock-free splitmix64: the state is a Weyl counter, so fetch_add is the
+// whole state update and the output mix runs outside the critical section.
+struct shared_atomic_splitmix {
+  std::atomic<uint64_t> state;
+  explicit shared_atomic_splitmix(uint64_t seed) : state(seed) {}
+  inline uint64_t next_u64() {
+    uint64_t z = state.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+};
+
+// Per-thread xoroshiro128++, seeded on first use from a shared counter.
+// The thread_local is static, so only one instance should be live at a time.
+struct thread_local_xoroshiro {
+  static inline std::atomic<uint64_t> base{0};
+  static inline std::atomic<uint64_t> seq{0};
+  explicit thread_local_xoroshiro(uint64_t seed) { base = seed; seq = 0; }
+  inline uint64_t next_u64() {
+    thread_local std::optional<xoroshiro128pp> gen;
+    if (!gen) {
+      splitmix64 seeder(base.load(std::memory_order_relaxed) + seq.fetch_add(1) * 0x9E3779B97F4A7C15ull);
+      gen.emplace(seeder.next());
+    }
+    return gen->next_u64();
+  }
+};
+
+// Cache-line padded generators indexed by the current CPU. A spinlock per
+// shard covers migration between reading the CPU id and using the shard;
+// it is almost always uncontended.
+struct sharded_xoroshiro {
+  struct alignas(64) Shard {
+    SpinLock lk;
+    xoroshiro128pp gen{0};
+  };
+  unsigned count;
+  std::unique_ptr<Shard[]> shards;
+
+  explicit sharded_xoroshiro(uint64_t seed) : count(hw_threads()), shards(new Shard[count]) {
+    splitmix64 seeder(seed);
+    for (unsigned i=0;i<count;++i) shards[i].gen = xoroshiro128pp(seeder.next());
+  }
+  inline uint64_t next_u64() {
+    Shard& s = shards[current_cpu() % count];
+    std::lock_guard<SpinLock> g(s.lk);
+    return s.gen.next_u64();
+  }
+};
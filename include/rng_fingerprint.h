@@ -0,0 +1,238 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <array>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// Stream fingerprinting for cross-build reproducibility checks.
+//
+// The first N u64 outputs of a stream are cut into fixed-size chunks and each
+// chunk is hashed on its own, so a mismatch against a golden file can be pinned
+// to the first divergent chunk instead of diffing full dumps.
+//
+// The hash is an XXH3-style accumulator: 8 independent 64-bit lanes, each
+// doing a 32x32->64 multiply per word, with a scramble every stripe. As in
+// XXH3, each word is keyed by its position in the stripe (not just its lane),
+// so words swapped within a lane, e.g. a stride-8 reorder from a wider SIMD
+// path, change the digest. The lane loop has no cross-lane dependencies so it
+// auto-vectorizes (AVX2/AVX-512/NEON) and runs at roughly memory bandwidth.
+// It hashes u64 values, not bytes, so results are independent of endianness.
+// Not a cryptographic hash.
+
+namespace fp_detail {
+  constexpr uint64_t mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+  template <size_t N>
+  constexpr std::array<uint64_t,N> make_key(uint64_t z) {
+    std::array<uint64_t,N> k{};
+    for (auto& v : k) { z += 0x9E3779B97F4A7C15ull; v = mix64(z); }
+    return k;
+  }
+  // per-lane key (init/scramble/digest) and per-position secret (one word per stripe slot)
+  inline constexpr std::array<uint64_t,8> key = make_key<8>(0x5EEDF1A9E5ull);
+  inline constexpr std::array<uint64_t,1024> secret = make_key<1024>(0x5EC2E7F1A9ull);
+}
+
+struct FpHasher {
+  static constexpr size_t kLanes  = 8;
+  static constexpr size_t kStripe = 1024; // words per stripe; scramble after each
+  static_assert(kStripe == fp_detail::secret.size(), "one secret word per stripe position");
+
+  alignas(64) uint64_t acc[kLanes];
+  uint64_t words = 0;
+
+  explicit FpHasher(uint64_t seed) {
+    for (size_t j=0;j<kLanes;++j) acc[j] = fp_detail::key[j] ^ fp_detail::mix64(seed + j);
+  }
+
+  // Exactly kStripe words. Call stripe() for every full stripe before tail().
+  inline void stripe(const uint64_t* p) {
+    for (size_t i=0;i<kStripe;i+=kLanes) accumulate(p + i, i);
+    scramble();
+    words += kStripe;
+  }
+
+  // Final partial stripe (len < kStripe); no more input after this.
+  inline void tail(const uint64_t* p, size_t len) {
+    size_t i = 0;
+    for (; i+kLanes<=len; i+=kLanes) accumulate(p + i, i);
+    for (; i<len; ++i) {
+      const uint64_t d = p[i];
+      const uint64_t k = d ^ fp_detail::secret[i];
+      acc[i & (kLanes-1)] += d + (k & 0xFFFFFFFFull) * (k >> 32);
+    }
+    words += len;
+  }
+
+  uint64_t digest() const {
+    uint64_t h = fp_detail::mix64(words * 0x9E3779B185EBCA87ull);
+    for (size_t j=0;j<kLanes;++j) h = fp_detail::mix64(h ^ acc[j] ^ fp_detail::key[j]) + j;
+    return h;
+  }
+
+private:
+  // p points at stripe position pos
+  inline void accumulate(const uint64_t* p, size_t pos) {
+    for (size_t j=0;j<kLanes;++j) {
+      const uint64_t d = p[j];
+      const uint64_t k = d ^ fp_detail::secret[pos + j];
+      acc[j] += d + (k & 0xFFFFFFFFull) * (k >> 32);
+    }
+  }
+  inline void scramble() {
+    for (size_t j=0;j<kLanes;++j) {
+      uint64_t a = acc[j];
+      a ^= a >> 47;
+      a ^= fp_detail::key[j];
+      acc[j] = a * 0x9E3779B1ull;
+    }
+  }
+};
+
+// Sanity check run before fingerprinting: reordering words, within a lane or
+// across a stripe boundary, must change the digest.
+inline bool fp_self_check() {
+  std::vector<uint64_t> buf(FpHasher::kStripe * 2 + 100);
+  uint64_t z = 0;
+  for (auto& v : buf) { z += 0x9E3779B97F4A7C15ull; v = fp_detail::mix64(z); }
+  auto digest = [](const std::vector<uint64_t>& b){
+    FpHasher h(0);
+    h.stripe(b.data());
+    h.stripe(b.data() + FpHasher::kStripe);
+    h.tail(b.data() + 2*FpHasher::kStripe, b.size() - 2*FpHasher::kStripe);
+    return h.digest();
+  };
+  const uint64_t ref = digest(buf);
+  static constexpr size_t swaps[][2] = {
+    {0, 8}, {3, 1019}, {1016, 1024}, {2048, 2056}, {2050, 2051}
+  };
+  for (auto& sw : swaps) {
+    auto b = buf;
+    std::swap(b[sw[0]], b[sw[1]]);
+    if (digest(b) == ref) return false;
+  }
+  return true;
+}
+
+struct FpChunk {
+  uint64_t index = 0;
+  uint64_t count = 0; // outputs in this chunk
+  uint64_t hash  = 0;
+};
+
+struct FpStream {
+  std::string gen;
+  unsigned stream = 0;
+  std::vector<FpChunk> chunks;
+  double secs = 0.0;
+
+  uint64_t outputs() const {
+    uint64_t n = 0;
+    for (auto& c : chunks) n += c.count;
+    return n;
+  }
+  // Order-sensitive fold of the chunk hashes.
+  uint64_t digest() const {
+    uint64_t h = 0;
+    for (auto& c : chunks) h = fp_detail::mix64(h ^ c.hash) + c.count;
+    return h;
+  }
+};
+
+struct FpParams {
+  uint64_t seed = 0;
+  uint64_t outputs = 0; // per stream
+  uint64_t chunk = 0;   // outputs per chunk, multiple of FpHasher::kStripe
+  unsigned streams = 0;
+};
+
+// Hash the first n outputs of make(seed) in chunks of `chunk` outputs.
+// make(seed) must return the generator by value (prvalue), so non-movable
+// instances such as CSimdLib::Instance work too.
+template <typename Make>
+inline std::vector<FpChunk> fingerprint_stream(Make&& make, uint64_t seed, uint64_t n, uint64_t chunk) {
+  auto rng = make(seed);
+  std::vector<FpChunk> out;
+  out.reserve(static_cast<size_t>((n + chunk - 1) / chunk));
+  alignas(64) uint64_t buf[FpHasher::kStripe];
+
+  for (uint64_t base = 0, idx = 0; base < n; base += chunk, ++idx) {
+    const uint64_t len = std::min(chunk, n - base);
+    FpHasher h(idx);
+    uint64_t done = 0;
+    for (; done + FpHasher::kStripe <= len; done += FpHasher::kStripe) {
+      for (size_t i=0;i<FpHasher::kStripe;++i) buf[i] = rng.next_u64();
+      h.stripe(buf);
+    }
+    if (done < len) {
+      const size_t rem = static_cast<size_t>(len - done);
+      for (size_t i=0;i<rem;++i) buf[i] = rng.next_u64();
+      h.tail(buf, rem);
+    }
+    out.push_back({idx, len, h.digest()});
+  }
+  return out;
+}
+
+// v1 files (position-independent hash) are rejected rather than misreported.
+inline constexpr const char* kFpGoldenVersion = "# rng_bench fingerprint v2";
+
+// Golden file: a version line, a params line, then one line per chunk:
+//   <generator> <stream> <chunk> <count> <hash hex>
+inline bool write_fp_golden(const std::string& path, const FpParams& p, const std::vector<FpStream>& S) {
+  std::ofstream out(path, std::ios::out | std::ios::trunc);
+  if (!out) return false;
+  out << kFpGoldenVersion << "\n";
+  out << "params " << std::hex << p.seed << std::dec << ' ' << p.outputs << ' ' << p.chunk << ' ' << p.streams << "\n";
+  char hex[17];
+  for (auto& s : S) {
+    for (auto& c : s.chunks) {
+      std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(c.hash));
+      out << s.gen << ' ' << s.stream << ' ' << c.index << ' ' << c.count << ' ' << hex << "\n";
+    }
+  }
+  out.flush();
+  return out.good();
+}
+
+inline bool read_fp_golden(const std::string& path, FpParams& p, std::vector<FpStream>& S) {
+  std::ifstream in(path);
+  if (!in) return false;
+  S.clear();
+  bool have_params = false;
+  std::string line;
+  if (!std::getline(in, line) || line != kFpGoldenVersion) {
+    std::fprintf(stderr, "[error] %s: not a '%s' golden file\n", path.c_str(), kFpGoldenVersion);
+    return false;
+  }
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream ls(line);
+    if (line.rfind("params ", 0) == 0) {
+      std::string tag;
+      ls >> tag >> std::hex >> p.seed >> std::dec >> p.outputs >> p.chunk >> p.streams;
+      if (!ls) return false;
+      have_params = true;
+      continue;
+    }
+    std::string gen;
+    unsigned stream = 0;
+    FpChunk c;
+    ls >> gen >> stream >> c.index >> c.count >> std::hex >> c.hash;
+    if (!ls) return false;
+    if (S.empty() || S.back().gen != gen || S.back().stream != stream) {
+      S.push_back({});
+      S.back().gen = gen;
+      S.back().stream = stream;
+    }
+    S.back().chunks.push_back(c);
+  }
+  return have_params;
+}
@@ -0,0 +1,213 @@
+#pragma once
+#include "rng_platform.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <iostream>
+#include <algorithm>
+
+#include <cerrno>
+
+#if !defined(_WIN32)
+  #include <poll.h>
+  #include <unistd.h>
+  #include <sys/types.h>
+  #include <sys/wait.h>
+#endif
+
+// Process-isolated job runner for --isolate / --jobs / --cpus.
+//
+// Each job runs in a freshly forked child, so heap state and function-static
+// aggregates never carry over between generators. The child returns its
+// result as an opaque payload over a pipe. Up to `slots` children run at
+// once; with a CPU list, the CPUs are split into `slots` disjoint groups and
+// each child is pinned to its own group before it starts any threads.
+
+struct IsolatedJob {
+  std::string name;
+  // Runs in the child with the CPUs it is pinned to (empty = unpinned).
+  // An empty payload means failure.
+  std::function<std::string(const std::vector<unsigned>&)> run;
+};
+
+#if defined(__linux__)
+inline constexpr unsigned long kMaxCpuId = CPU_SETSIZE;
+#else
+inline constexpr unsigned long kMaxCpuId = 1024;
+#endif
+
+// Parse "0-3,8,10-11" into CPU ids. Every item must be a whole number or
+// range, and ids must be below kMaxCpuId.
+inline bool parse_cpu_list(const std::string& s, std::vector<unsigned>& out) {
+  out.clear();
+  // digits only; strtoul alone would take "-1", " 3" or "3x"
+  auto parse_id = [](const char* b, const char* e, unsigned long& v) {
+    if (b == e) return false;
+    for (const char* q = b; q != e; ++q) if (*q < '0' || *q > '9') return false;
+    errno = 0;
+    char* end = nullptr;
+    v = std::strtoul(b, &end, 10);
+    return end == e && errno == 0 && v < kMaxCpuId;
+  };
+  size_t pos = 0;
+  while (pos <= s.size()) {
+    size_t comma = s.find(',', pos);
+    if (comma == std::string::npos) comma = s.size();
+    const std::string item = s.substr(pos, comma - pos);
+    const char* b = item.c_str();
+    const char* e = b + item.size();
+    const size_t dash = item.find('-');
+    unsigned long lo = 0, hi = 0;
+    if (dash == std::string::npos) {
+      if (!parse_id(b, e, lo)) return false;
+      hi = lo;
+    } else if (!parse_id(b, b + dash, lo) || !parse_id(b + dash + 1, e, hi) || hi < lo) {
+      return false;
+    }
+    for (unsigned long c = lo; c <= hi; ++c) out.push_back(static_cast<unsigned>(c));
+    pos = comma + 1;
+  }
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+  return !out.empty();
+}
+
+// Pin the calling process (and threads it creates later) to `cpus`, which
+// come from parse_cpu_list and so are all below kMaxCpuId.
+inline bool pin_to_cpus(const std::vector<unsigned>& cpus) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (unsigned c : cpus) CPU_SET(c, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)cpus;
+  return false;
+#endif
+}
+
+#if defined(_WIN32)
+
+// No fork(): run the jobs in-process, one after another.
+inline std::vector<std::optional<std::string>> run_isolated(const std::vector<IsolatedJob>& jobs, unsigned slots,
+                                                            const std::vector<unsigned>& cpus) {
+  (void)slots; (void)cpus;
+  std::fprintf(stderr, "[warn] process isolation needs fork(); running jobs in-process\n");
+  std::vector<std::optional<std::string>> out(jobs.size());
+  for (size_t j=0;j<jobs.size();++j) {
+    std::string p = jobs[j].run({});
+    if (!p.empty()) out[j] = std::move(p);
+  }
+  return out;
+}
+
+#else
+
+inline std::vector<std::optional<std::string>> run_isolated(const std::vector<IsolatedJob>& jobs, unsigned slots,
+                                                            const std::vector<unsigned>& cpus) {
+  std::vector<std::optional<std::string>> out(jobs.size());
+  if (jobs.empty()) return out;
+
+  slots = std::max(1u, std::min<unsigned>(slots, static_cast<unsigned>(jobs.size())));
+  if (!cpus.empty()) slots = std::min<unsigned>(slots, static_cast<unsigned>(cpus.size()));
+
+  // contiguous, disjoint CPU groups, one per slot
+  std::vector<std::vector<unsigned>> groups(slots);
+  for (unsigned s=0;s<slots && !cpus.empty();++s) {
+    const size_t b = s * cpus.size() / slots, e = (s + 1) * cpus.size() / slots;
+    groups[s].assign(cpus.begin() + b, cpus.begin() + e);
+  }
+
+  struct Child {
+    pid_t pid;
+    int fd;
+    size_t job;
+    unsigned slot;
+    std::string buf;
+  };
+  std::vector<Child> running;
+  std::vector<bool> busy(slots, false);
+  size_t next = 0;
+
+  auto launch = [&](unsigned slot) -> bool {
+    int fds[2];
+    if (pipe(fds) != 0) { std::perror("pipe"); return false; }
+    // don't let the child inherit (and later flush) buffered output
+    std::cout.flush();
+    std::fflush(stdout);
+    std::fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) { std::perror("fork"); close(fds[0]); close(fds[1]); return false; }
+    if (pid == 0) {
+      close(fds[0]);
+      for (auto& r : running) close(r.fd);
+      if (!groups[slot].empty() && !pin_to_cpus(groups[slot])) {
+        std::fprintf(stderr, "[warn] %s: failed to set CPU affinity\n", jobs[next].name.c_str());
+      }
+      const std::string payload = jobs[next].run(groups[slot]);
+      std::cout.flush();
+      std::fflush(stdout);
+      size_t off = 0;
+      while (off < payload.size()) {
+        ssize_t n = write(fds[1], payload.data() + off, payload.size() - off);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) _exit(2);
+        off += static_cast<size_t>(n);
+      }
+      close(fds[1]);
+      _exit(payload.empty() ? 1 : 0);
+    }
+    close(fds[1]);
+    running.push_back({pid, fds[0], next, slot, {}});
+    busy[slot] = true;
+    ++next;
+    return true;
+  };
+
+  while (next < jobs.size() || !running.empty()) {
+    for (unsigned s=0;s<slots && next<jobs.size();++s) {
+      if (busy[s]) continue;
+      if (!launch(s)) { ++next; }
+    }
+    if (running.empty()) continue;
+
+    std::vector<pollfd> pfds(running.size());
+    for (size_t i=0;i<running.size();++i) pfds[i] = {running[i].fd, POLLIN, 0};
+    if (poll(pfds.data(), pfds.size(), -1) < 0) {
+      if (errno == EINTR) continue;
+      std::perror("poll");
+      break;
+    }
+
+    for (size_t i=running.size(); i-- > 0; ) {
+      if (!(pfds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+      Child& c = running[i];
+      char tmp[4096];
+      ssize_t n = read(c.fd, tmp, sizeof(tmp));
+      if (n < 0 && errno == EINTR) continue;
+      if (n > 0) { c.buf.append(tmp, static_cast<size_t>(n)); continue; }
+
+      // EOF: reap the child
+      close(c.fd);
+      int status = 0;
+      while (waitpid(c.pid, &status, 0) < 0 && errno == EINTR) {}
+      if (WIFEXITED(status) && WEXITSTATUS(status) == 0 && !c.buf.empty()) {
+        out[c.job] = std::move(c.buf);
+      } else if (WIFSIGNALED(status)) {
+        std::fprintf(stderr, "[error] %s: child killed by signal %d\n", jobs[c.job].name.c_str(), WTERMSIG(status));
+      } else {
+        std::fprintf(stderr, "[error] %s: child exited with status %d\n", jobs[c.job].name.c_str(),
+                     WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+      }
+      busy[c.slot] = false;
+      running.erase(running.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+  }
+  return out;
+}
+
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+#include "rng_platform.h"
+#include <cstdint>
+
+// 128-bit multiplicative congruential generator (Lehmer), returns the high
+// 64 bits of the state. Multiplier from Steele & Vigna, "Computationally
+// easy, spectrally good multipliers for congruential pseudorandom number
+// generators". State must be odd.
+struct mcg128 {
+  static constexpr uint64_t kMul = 0xDA942042E4DD58B5ull;
+  uint64_t hi, lo;
+  explicit mcg128(uint64_t seed) {
+    // seed via splitmix64 chain
+    uint64_t z = seed;
+    auto sm = [&z](){
+      z += 0x9E3779B97F4A7C15ull;
+      uint64_t t = z;
+      t = (t ^ (t >> 30)) * 0xBF58476D1CE4E5B9ull;
+      t = (t ^ (t >> 27)) * 0x94D049BB133111EBull;
+      return t ^ (t >> 31);
+    };
+    hi = sm(); lo = sm() | 1u;
+  }
+  inline uint64_t next_u64() {
+    // state *= kMul (mod 2^128)
+    uint64_t l;
+    hi = mul_u64_wide(lo, kMul, &l) + hi * kMul;
+    lo = l;
+    return hi;
+  }
+  inline double next_double() {
+    return (next_u64() >> 11) * (1.0/9007199254740992.0);
+  }
+};
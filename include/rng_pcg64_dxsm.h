@@ -0,0 +1,62 @@
+#pragma once
+#include "rng_platform.h"
+#include <cstdint>
+
+// PCG64-DXSM – 128-bit LCG with the "cheap multiplier" and DXSM output,
+// as used by NumPy's PCG64DXSM. State is kept as two u64 halves so the
+// same code builds on MSVC; mul_u64_wide lowers to a single mul/mulx.
+struct pcg64_dxsm {
+  static constexpr uint64_t kMul = 0xDA942042E4DD58B5ull;
+  uint64_t hi, lo;         // state
+  uint64_t inc_hi, inc_lo; // increment, must be odd
+
+  explicit pcg64_dxsm(uint64_t seed) {
+    // seed via splitmix64 chain
+    uint64_t z = seed;
+    auto sm = [&z](){
+      z += 0x9E3779B97F4A7C15ull;
+      uint64_t t = z;
+      t = (t ^ (t >> 30)) * 0xBF58476D1CE4E5B9ull;
+      t = (t ^ (t >> 27)) * 0x94D049BB133111EBull;
+      return t ^ (t >> 31);
+    };
+    const uint64_t s_hi = sm(), s_lo = sm();
+    const uint64_t q_hi = sm(), q_lo = sm();
+    // inc = (seq << 1) | 1
+    inc_hi = (q_hi << 1) | (q_lo >> 63);
+    inc_lo = (q_lo << 1) | 1u;
+    hi = 0; lo = 0;
+    step();
+    add(s_hi, s_lo);
+    step();
+  }
+
+  inline uint64_t next_u64() {
+    // DXSM on the pre-step state
+    uint64_t h = hi;
+    const uint64_t l = lo | 1u;
+    h ^= h >> 32;
+    h *= kMul;
+    h ^= h >> 48;
+    h *= l;
+    step();
+    return h;
+  }
+  inline double next_double() {
+    return (next_u64() >> 11) * (1.0/9007199254740992.0);
+  }
+
+private:
+  inline void add(uint64_t a_hi, uint64_t a_lo) {
+    const uint64_t l = lo + a_lo;
+    hi = hi + a_hi + (l < lo);
+    lo = l;
+  }
+  // state = state * kMul + inc (mod 2^128)
+  inline void step() {
+    uint64_t l;
+    const uint64_t h = mul_u64_wide(lo, kMul, &l) + hi * kMul;
+    hi = h; lo = l;
+    add(inc_hi, inc_lo);
+  }
+};
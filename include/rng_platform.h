@@ -9,6 +9,7 @@
 #if defined(_WIN32)
   #define NOMINMAX
   #include <windows.h>
+  #include <intrin.h>
   using LibHandle = HMODULE;
   inline LibHandle open_library(const std::string& path) {
     return LoadLibraryA(path.c_str());
@@ -21,6 +22,7 @@
   }
 #else
   #include <dlfcn.h>
+  #include <sched.h>
   using LibHandle = void*;
   inline LibHandle open_library(const std::string& path) {
     return dlopen(path.c_str(), RTLD_NOW);
@@ -38,6 +40,33 @@ inline unsigned hw_threads() {
   return n ? n : 1;
 }
 
+#if defined(__x86_64__) || defined(__i386__)
+  #include <immintrin.h>
+#endif
+
+// Spin-wait hint for busy loops.
+inline void cpu_relax() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+  _mm_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+// CPU the calling thread is running on right now (may change at any time).
+inline unsigned current_cpu() {
+#if defined(_WIN32)
+  return static_cast<unsigned>(GetCurrentProcessorNumber());
+#elif defined(__linux__)
+  int c = sched_getcpu();
+  return c < 0 ? 0u : static_cast<unsigned>(c);
+#else
+  return static_cast<unsigned>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+}
+
 using clock_type = std::chrono::steady_clock;
 
 struct ScopedTimer {
@@ -48,3 +77,23 @@ struct ScopedTimer {
     return duration<double>(clock_type::now() - t0).count();
   }
 };
+
+// 64x64 -> 128-bit multiply. Returns the high half, low half via *lo.
+inline uint64_t mul_u64_wide(uint64_t a, uint64_t b, uint64_t* lo) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+  *lo = static_cast<uint64_t>(p);
+  return static_cast<uint64_t>(p >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  uint64_t hi;
+  *lo = _umul128(a, b, &hi);
+  return hi;
+#else
+  const uint64_t a0 = a & 0xFFFFFFFFull, a1 = a >> 32;
+  const uint64_t b0 = b & 0xFFFFFFFFull, b1 = b >> 32;
+  const uint64_t p00 = a0*b0, p01 = a0*b1, p10 = a1*b0, p11 = a1*b1;
+  const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFull) + (p10 & 0xFFFFFFFFull);
+  *lo = (mid << 32) | (p00 & 0xFFFFFFFFull);
+  return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
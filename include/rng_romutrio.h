@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+// RomuTrio – Mark A. Overton, "Romu: Fast Nonlinear Pseudo-Random Number Generators
+// Providing High Quality" (2020), https://www.romu-random.org/
+struct romutrio {
+  uint64_t x, y, z;
+  static inline uint64_t rotl(uint64_t v, int k) {
+    return (v << k) | (v >> (64 - k));
+  }
+  explicit romutrio(uint64_t seed) {
+    // seed via splitmix64 chain
+    uint64_t s = seed;
+    auto sm = [&s](){
+      s += 0x9E3779B97F4A7C15ull;
+      uint64_t t = s;
+      t = (t ^ (t >> 30)) * 0xBF58476D1CE4E5B9ull;
+      t = (t ^ (t >> 27)) * 0x94D049BB133111EBull;
+      return t ^ (t >> 31);
+    };
+    x = sm(); y = sm(); z = sm();
+  }
+  inline uint64_t next_u64() {
+    const uint64_t xp = x, yp = y, zp = z;
+    x = 15241094284759029579ull * zp;
+    y = rotl(yp - xp, 12);
+    z = rotl(zp - yp, 44);
+    return xp;
+  }
+  inline double next_double() {
+    return (next_u64() >> 11) * (1.0/9007199254740992.0);
+  }
+};
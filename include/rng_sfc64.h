@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+// sfc64 – Chris Doty-Humphrey's Small Fast Chaotic generator (PractRand, public domain)
+struct sfc64 {
+  uint64_t a, b, c, counter;
+  static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+  explicit sfc64(uint64_t seed) : a(seed), b(seed), c(seed), counter(1) {
+    for (int i=0;i<12;++i) next_u64();
+  }
+  inline uint64_t next_u64() {
+    const uint64_t tmp = a + b + counter++;
+    a = b ^ (b >> 11);
+    b = c + (c << 3);
+    c = rotl(c, 24) + tmp;
+    return tmp;
+  }
+  inline double next_double() {
+    return (next_u64() >> 11) * (1.0/9007199254740992.0);
+  }
+};
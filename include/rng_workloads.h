@@ -0,0 +1,142 @@
+#pragma once
+#include "rng_platform.h"
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+// Application-level kernels for the --workloads mode. Each one takes any
+// generator with next_u64()/next_double(), so the same code runs against the
+// built-in generators and the csimd adapter.
+
+// Unbiased integer in [0, n), n > 0 (Lemire's multiply-shift with rejection).
+template <typename RNG>
+inline uint64_t bounded_u64(RNG& rng, uint64_t n) {
+  uint64_t lo;
+  uint64_t hi = mul_u64_wide(rng.next_u64(), n, &lo);
+  if (lo < n) {
+    const uint64_t t = (0 - n) % n;
+    while (lo < t) hi = mul_u64_wide(rng.next_u64(), n, &lo);
+  }
+  return hi;
+}
+
+// Two unbiased integers in [0, n1) and [0, n2) from a single u64
+// (Brackett-Luce & Lemire, batched ranged generation). n1*n2 must be
+// nonzero and fit in 64 bits.
+template <typename RNG>
+inline void bounded_u64_pair(RNG& rng, uint64_t n1, uint64_t n2, uint64_t& r1, uint64_t& r2) {
+  const uint64_t prod = n1 * n2;
+  for (;;) {
+    uint64_t lo;
+    r1 = mul_u64_wide(rng.next_u64(), n1, &lo);
+    r2 = mul_u64_wide(lo, n2, &lo);
+    if (lo >= prod) return;
+    if (lo >= (0 - prod) % prod) return;
+  }
+}
+
+// Fisher-Yates, two swaps per draw while i*(i-1) fits in 64 bits.
+// Returns the number of u64 draws used (ignoring rare rejections).
+template <typename RNG, typename T>
+inline uint64_t shuffle_batched(RNG& rng, T* a, uint64_t n) {
+  uint64_t draws = 0;
+  uint64_t i = n;
+  for (; i > 0xFFFFFFFFull; --i, ++draws) {
+    std::swap(a[i-1], a[bounded_u64(rng, i)]);
+  }
+  for (; i > 2; i -= 2, ++draws) {
+    uint64_t j1, j2;
+    bounded_u64_pair(rng, i, i-1, j1, j2);
+    std::swap(a[i-1], a[j1]);
+    std::swap(a[i-2], a[j2]);
+  }
+  if (i == 2) { std::swap(a[1], a[bounded_u64(rng, 2)]); ++draws; }
+  return draws;
+}
+
+// Algorithm R: uniform k-subset of in[0..n) into out[0..k), one draw per item past k.
+template <typename RNG, typename T>
+inline void reservoir_sample(RNG& rng, const T* in, uint64_t n, T* out, uint64_t k) {
+  uint64_t i = 0;
+  for (; i<k && i<n; ++i) out[i] = in[i];
+  for (; i<n; ++i) {
+    const uint64_t j = bounded_u64(rng, i + 1);
+    if (j < k) out[j] = in[i];
+  }
+}
+
+// Walker/Vose alias table: O(1) sampling from a discrete distribution.
+struct AliasTable {
+  std::vector<double> prob;
+  std::vector<uint32_t> alias;
+
+  explicit AliasTable(const std::vector<double>& w) : prob(w.size()), alias(w.size()) {
+    const size_t n = w.size();
+    double sum = 0.0;
+    for (double x : w) sum += x;
+    std::vector<double> p(n);
+    std::vector<uint32_t> small, large;
+    for (size_t i=0;i<n;++i) {
+      p[i] = w[i] * (double)n / sum;
+      (p[i] < 1.0 ? small : large).push_back((uint32_t)i);
+    }
+    while (!small.empty() && !large.empty()) {
+      uint32_t s = small.back(); small.pop_back();
+      uint32_t l = large.back(); large.pop_back();
+      prob[s] = p[s];
+      alias[s] = l;
+      p[l] = (p[l] + p[s]) - 1.0;
+      (p[l] < 1.0 ? small : large).push_back(l);
+    }
+    for (uint32_t i : large) { prob[i] = 1.0; alias[i] = i; }
+    for (uint32_t i : small) { prob[i] = 1.0; alias[i] = i; } // rounding leftovers
+  }
+
+  template <typename RNG>
+  inline uint32_t sample(RNG& rng) const {
+    uint64_t lo;
+    const uint32_t col = (uint32_t)mul_u64_wide(rng.next_u64(), prob.size(), &lo);
+    return rng.next_double() < prob[col] ? col : alias[col];
+  }
+};
+
+// Points of the unit square that fall inside the quarter circle.
+template <typename RNG>
+inline uint64_t monte_carlo_pi_hits(RNG& rng, uint64_t samples) {
+  uint64_t hits = 0;
+  for (uint64_t i=0;i<samples;++i) {
+    const double x = rng.next_double();
+    const double y = rng.next_double();
+    hits += (x*x + y*y <= 1.0);
+  }
+  return hits;
+}
+
+// Simple symmetric walk on Z, one bit per step; steps is a multiple of 64.
+// Returns the final position.
+template <typename RNG>
+inline int64_t random_walk_1d(RNG& rng, uint64_t steps) {
+  int64_t pos = 0;
+  for (uint64_t s=0;s<steps;s+=64) {
+    uint64_t bits = rng.next_u64();
+    for (int b=0;b<64;++b, bits>>=1) pos += (int64_t)(bits & 1) * 2 - 1;
+  }
+  return pos;
+}
+
+// Lattice walk on Z^2, two bits per step (N/E/S/W); steps is a multiple of 32.
+// Returns the squared distance from the origin at the end.
+template <typename RNG>
+inline int64_t random_walk_2d(RNG& rng, uint64_t steps) {
+  static constexpr int dx[4] = { 1, 0, -1, 0 };
+  static constexpr int dy[4] = { 0, 1, 0, -1 };
+  int64_t x = 0, y = 0;
+  for (uint64_t s=0;s<steps;s+=32) {
+    uint64_t bits = rng.next_u64();
+    for (int b=0;b<32;++b, bits>>=2) {
+      x += dx[bits & 3];
+      y += dy[bits & 3];
+    }
+  }
+  return x*x + y*y;
+}
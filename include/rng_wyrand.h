@@ -0,0 +1,19 @@
+#pragma once
+#include "rng_platform.h"
+#include <cstdint>
+
+// wyrand – Wang Yi's 64-bit generator from wyhash (public domain / Unlicense)
+// https://github.com/wangyi-fudan/wyhash
+struct wyrand {
+  uint64_t state;
+  explicit wyrand(uint64_t seed) : state(seed) {}
+  inline uint64_t next_u64() {
+    state += 0xA0761D6478BD642Full;
+    uint64_t lo;
+    const uint64_t hi = mul_u64_wide(state, state ^ 0xE7037ED1A0B428DBull, &lo);
+    return hi ^ lo;
+  }
+  inline double next_double() {
+    return (next_u64() >> 11) * (1.0/9007199254740992.0);
+  }
+};
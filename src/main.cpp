@@ -9,15 +9,29 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <memory>
+#include <numeric>
 
 #include "rng_platform.h"
 #include "rng_stats.h"
 #include "rng_csv.h"
+#include "rng_fingerprint.h"
+#include "rng_workloads.h"
+#include "rng_contention.h"
+#include "rng_isolate.h"
 
 #include "rng_splitmix64.h"
 #include "rng_pcg32.h"
 #include "rng_xoroshiro128pp.h"
 // #include "rng_xoshiro256ss.h"
+#include "rng_pcg64_dxsm.h"
+#include "rng_wyrand.h"
+#include "rng_sfc64.h"
+#include "rng_mcg128.h"
+#include "rng_romutrio.h"
 #include "rng_std_wrappers.h"
 #include "rng_csimd_dynamic.h"
 
@@ -40,12 +54,33 @@ struct BenchResult {
 struct Cmd {
   uint64_t total = 100000000ULL; // total samples per generator
   unsigned threads = hw_threads();
+  bool threads_given = false;       // --threads passed explicitly
   std::string csv_path;
   std::string csimd_path; // path to your lib(.so/.dll/.dylib); if empty, skip
   int csimd_algo = 0;     // e.g. 0 for xoroshiro128++, per your lib's mapping
   int csimd_bitwidth = 1; // 1 = 64-bit
   uint64_t seed = 0xC0FFEED5EEDULL;
   std::vector<std::string> gens; // if empty -> all
+
+  // fingerprint mode (--fingerprint / --fp-verify)
+  uint64_t fp_outputs = 0;          // outputs hashed per stream; 0 = off
+  uint64_t fp_chunk = 1ULL << 20;   // outputs per chunk
+  unsigned fp_streams = 4;          // seeds per generator
+  std::string fp_golden;            // write golden file here
+  std::string fp_verify;            // compare against this golden file
+  bool fp_params_given = false;     // --fp-chunk / --fp-streams passed explicitly
+
+  // workload mode (--workloads)
+  bool workloads = false;
+  uint64_t wl_size = 1ULL << 24;    // elements / samples / steps per workload
+
+  // contention mode (--contention)
+  bool contention = false;
+
+  // process isolation (--isolate / --jobs / --cpus)
+  bool isolate = false;
+  unsigned jobs = 1;                // generators benchmarked concurrently
+  std::vector<unsigned> cpus;       // cpuset split across jobs; empty = no pinning
 };
 
 static void usage(const char* argv0) {
@@ -58,18 +93,54 @@ options:
   --seed S              base seed (u64, default 0xC0FFEED5EED)
   --csv PATH            write results to CSV at PATH
   --gens LIST           comma-separated list: std_mt19937,std_mt19937_64,std_minstd,ranlux48,
-                        xoroshiro128pp,xoshiro256ss,pcg32,csimd
+                        xoroshiro128pp,xoshiro256ss,pcg32,pcg64_dxsm,wyrand,sfc64,
+                        mcg128,romutrio,csimd
   --csimd-lib PATH      path to your C-SIMD-RNG shared lib (dll/so/dylib)
   --csimd-algo ID       algorithm id to pass to universal_rng_new (default 0)
   --csimd-bw   BW       bitwidth to pass (1=64-bit) (default 1)
   --help
 
+process isolation (POSIX; in-process fallback elsewhere):
+  --isolate             run each generator benchmark in its own forked child process
+  --jobs J              run up to J children at once (implies --isolate, default 1;
+                        J > 1 requires --cpus)
+  --cpus LIST           cpuset such as 0-15 or 0-7,16-23 (implies --isolate); split
+                        into J disjoint groups, one child pinned to each group; without
+                        --threads each child uses one thread per CPU in its group
+  (bench mode only; rejected with --fingerprint, --workloads or --contention)
+
+fingerprint mode (reproducibility checks, no benchmarking):
+  --fingerprint N       hash the first N u64 outputs of each generator and seed
+  --fp-chunk C          outputs per hashed chunk (default 1048576, rounded up to 1024)
+  --fp-streams K        seeds per generator, seeded like bench thread 0..K-1 (default 4)
+  --fp-golden PATH      write chunk hashes to a golden file
+  --fp-verify PATH      recompute every stream in the golden file with its parameters
+                        (--gens is ignored) and report the first divergent chunk;
+                        exit 1 on any mismatch or stream that could not be recomputed
+  (--fp-chunk/--fp-streams/--fp-golden need --fingerprint; --fp-verify excludes it)
+
+workload mode (application kernels instead of raw throughput):
+  --workloads           run shuffle, reservoir, alias, pi, walk1d, walk2d on each
+                        generator with 1 and T threads (CSV via --csv)
+  --wl-size N           elements / samples / steps per workload (default 16777216)
+
+contention mode (one generator shared by all threads):
+  --contention          compare mutex, spinlock, atomic splitmix64, thread_local and
+                        per-CPU sharded generators at 1,2,4,..,T threads; each thread
+                        draws --total/T outputs; p50 is per call from timed batches
+                        of 8, p99/p99.9 from single timed calls, timer overhead
+                        subtracted from both (CSV via --csv)
+
 examples:
   Linux/macOS:
     ./rng_bench --total 200000000 --threads 8 --csimd-lib /home/wofl/C-SIMD-RNG-Lib/lib_files/linux_shared/libuniversal_rng.so
 
   Windows (PowerShell):
     .\build\rng_bench.exe --total 200000000 --threads 8 --csimd-lib "C:\GitHub\C-SIMD-RNG-Lib\lib_files\mingw_shared\universal_rng.dll"
+
+  Fingerprint, then check another build against it:
+    ./rng_bench --fingerprint 1000000000 --fp-golden golden.txt --csimd-lib ./libuniversal_rng.so
+    ./rng_bench --fp-verify golden.txt --csimd-lib ./libuniversal_rng.so
 )", argv0);
 }
 
@@ -80,7 +151,7 @@ static Cmd parse(int argc, char** argv) {
     auto need = [&](int more){ if (i+more>=argc) { usage(argv[0]); std::exit(1);} };
     if (a=="--help" || a=="-h") { usage(argv[0]); std::exit(0); }
     else if (a=="--total") { need(1); c.total = std::stoull(argv[++i]); }
-    else if (a=="--threads") { need(1); c.threads = (unsigned)std::stoul(argv[++i]); if (c.threads==0) c.threads=1; }
+    else if (a=="--threads") { need(1); c.threads = (unsigned)std::stoul(argv[++i]); if (c.threads==0) c.threads=1; c.threads_given = true; }
     else if (a=="--seed") { need(1); std::stringstream ss; ss<<std::hex<<argv[++i]; ss>>c.seed; if(!ss) c.seed = std::stoull(argv[i]); }
     else if (a=="--csv") { need(1); c.csv_path = argv[++i]; }
     else if (a=="--gens") { need(1); 
@@ -95,11 +166,86 @@ static Cmd parse(int argc, char** argv) {
     else if (a=="--csimd-lib") { need(1); c.csimd_path = argv[++i]; }
     else if (a=="--csimd-algo") { need(1); c.csimd_algo = std::stoi(argv[++i]); }
     else if (a=="--csimd-bw") { need(1); c.csimd_bitwidth = std::stoi(argv[++i]); }
+    else if (a=="--fingerprint") { need(1); c.fp_outputs = std::stoull(argv[++i]); }
+    else if (a=="--fp-chunk") { need(1); c.fp_chunk = std::stoull(argv[++i]); c.fp_params_given = true; }
+    else if (a=="--fp-streams") { need(1); c.fp_streams = (unsigned)std::stoul(argv[++i]); if (c.fp_streams==0) c.fp_streams=1; c.fp_params_given = true; }
+    else if (a=="--fp-golden") { need(1); c.fp_golden = argv[++i]; }
+    else if (a=="--fp-verify") { need(1); c.fp_verify = argv[++i]; }
+    else if (a=="--workloads") { c.workloads = true; }
+    else if (a=="--wl-size") { need(1); c.wl_size = std::stoull(argv[++i]); }
+    else if (a=="--contention") { c.contention = true; }
+    else if (a=="--isolate") { c.isolate = true; }
+    else if (a=="--jobs") { need(1); c.jobs = (unsigned)std::stoul(argv[++i]); if (c.jobs==0) c.jobs=1; c.isolate = true; }
+    else if (a=="--cpus") { need(1);
+      if (!parse_cpu_list(argv[++i], c.cpus)) { std::fprintf(stderr, "bad --cpus list: %s\n", argv[i]); std::exit(1); }
+      c.isolate = true;
+    }
     else { std::fprintf(stderr, "unknown option: %s\n", a.c_str()); usage(argv[0]); std::exit(1); }
   }
+  if (c.fp_outputs && !c.fp_verify.empty()) {
+    std::fprintf(stderr, "--fingerprint and --fp-verify are separate modes; --fp-verify takes its "
+                         "parameters from the golden file\n");
+    std::exit(1);
+  }
+  if (!c.fp_outputs && (!c.fp_golden.empty() || c.fp_params_given)) {
+    std::fprintf(stderr, "--fp-golden/--fp-chunk/--fp-streams need --fingerprint N\n");
+    std::exit(1);
+  }
+  if (c.isolate && (c.fp_outputs || !c.fp_verify.empty() || c.workloads || c.contention)) {
+    std::fprintf(stderr, "--isolate/--jobs/--cpus only apply to the default bench mode, not to "
+                         "--fingerprint, --fp-verify, --workloads or --contention\n");
+    std::exit(1);
+  }
+  if (c.jobs > 1 && c.cpus.empty()) {
+    std::fprintf(stderr, "--jobs %u needs --cpus so concurrent children run on disjoint cores\n", c.jobs);
+    std::exit(1);
+  }
+  const uint64_t stripe = FpHasher::kStripe;
+  c.fp_chunk = c.fp_chunk ? (c.fp_chunk + stripe - 1) / stripe * stripe : stripe;
   return c;
 }
 
+// default list: every --gens tag
+static std::vector<std::string> all_gen_tags() {
+  return {
+    "std_mt19937",
+    "std_mt19937_64",
+    "std_minstd",
+    "ranlux48",
+    "xoroshiro128pp",
+//    "xoshiro256ss",
+    "pcg32",
+    "pcg64_dxsm",
+    "wyrand",
+    "sfc64",
+    "mcg128",
+    "romutrio",
+    "csimd"
+  };
+}
+
+static bool wants_gen(const Cmd& cmd, const char* tag) {
+  return std::find(cmd.gens.begin(), cmd.gens.end(), std::string(tag)) != cmd.gens.end();
+}
+
+// Calls visit(std::type_identity<RNG>{}, name) for every selected built-in
+// generator, in table order. csimd is loaded at runtime and handled separately.
+template <typename Visit>
+static void for_each_fixed_gen(const Cmd& cmd, Visit&& visit) {
+  if (wants_gen(cmd, "std_mt19937"))    visit(std::type_identity<std_mt19937>{}, "std_mt19937");
+  if (wants_gen(cmd, "std_mt19937_64")) visit(std::type_identity<std_mt19937_64>{}, "std_mt19937_64");
+  if (wants_gen(cmd, "std_minstd"))     visit(std::type_identity<std_minstd_rand>{}, "minstd_rand");
+  if (wants_gen(cmd, "ranlux48"))       visit(std::type_identity<std_ranlux48>{}, "ranlux48");
+  if (wants_gen(cmd, "xoroshiro128pp")) visit(std::type_identity<xoroshiro128pp>{}, "xoroshiro128pp");
+//  if (wants_gen(cmd, "xoshiro256ss"))   visit(std::type_identity<xoshiro256ss>{}, "xoshiro256ss");
+  if (wants_gen(cmd, "pcg32"))          visit(std::type_identity<pcg32>{}, "pcg32");
+  if (wants_gen(cmd, "pcg64_dxsm"))     visit(std::type_identity<pcg64_dxsm>{}, "pcg64_dxsm");
+  if (wants_gen(cmd, "wyrand"))         visit(std::type_identity<wyrand>{}, "wyrand");
+  if (wants_gen(cmd, "sfc64"))          visit(std::type_identity<sfc64>{}, "sfc64");
+  if (wants_gen(cmd, "mcg128"))         visit(std::type_identity<mcg128>{}, "mcg128");
+  if (wants_gen(cmd, "romutrio"))       visit(std::type_identity<romutrio>{}, "romutrio");
+}
+
 template <typename RNG>
 static BenchResult run_bench_fixed(const std::string& name, const Cmd& cmd) {
   BenchResult r; r.name = name; r.threads = cmd.threads;
@@ -286,6 +432,654 @@ static BenchResult run_bench_csimd(const std::string& name, const Cmd& cmd, cons
   return r;
 }
 
+// ---- fingerprint mode -------------------------------------------------------
+
+struct FpJob {
+  std::string gen;
+  unsigned stream = 0;
+  std::function<std::vector<FpChunk>()> run;
+};
+
+static void print_fp_table(const std::vector<FpStream>& S) {
+  auto w = [](int n){ return std::setw(n); };
+  std::cout << std::left
+    << w(20) << "generator"
+    << w(8)  << "stream"
+    << w(14) << "outputs"
+    << w(10) << "chunks"
+    << w(20) << "digest"
+    << w(10) << "GB/s"
+    << "\n";
+  std::cout << std::string(20+8+14+10+20+10, '-') << "\n";
+  for (auto& s : S) {
+    char hex[19];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(s.digest()));
+    const double gbs = s.secs > 0.0 ? (double)s.outputs() * 8.0 / s.secs / 1e9 : 0.0;
+    std::cout << std::left
+      << w(20) << s.gen
+      << w(8)  << s.stream
+      << w(14) << s.outputs()
+      << w(10) << s.chunks.size()
+      << w(20) << hex
+      << w(10) << std::fixed << std::setprecision(2) << gbs
+      << "\n";
+  }
+}
+
+// Streams have no jump-ahead, so chunks of one stream are produced in order;
+// parallelism is across (generator, seed) streams. When verifying, the
+// generators and streams come from the golden file and --gens is ignored.
+static int run_fingerprint(const Cmd& cmd) {
+  if (!fp_self_check()) {
+    std::fprintf(stderr, "[error] fingerprint hash self-check failed: reordered words hash equal\n");
+    return 1;
+  }
+  FpParams p{cmd.seed, cmd.fp_outputs, cmd.fp_chunk, cmd.fp_streams};
+  std::vector<FpStream> golden;
+  if (!cmd.fp_verify.empty()) {
+    if (!read_fp_golden(cmd.fp_verify, p, golden)) {
+      std::fprintf(stderr, "[error] failed to read golden file: %s\n", cmd.fp_verify.c_str());
+      return 1;
+    }
+    std::fprintf(stderr, "[info] verifying against %s (outputs=%llu chunk=%llu streams=%u)\n",
+      cmd.fp_verify.c_str(), (unsigned long long)p.outputs, (unsigned long long)p.chunk, p.streams);
+  }
+
+  const bool verify = !cmd.fp_verify.empty();
+  Cmd sel = cmd;
+  if (verify) sel.gens = all_gen_tags();
+
+  // stream ids to compute for a generator
+  auto streams_for = [&](const std::string& name){
+    std::vector<unsigned> ids;
+    if (!verify) {
+      for (unsigned s=0;s<p.streams;++s) ids.push_back(s);
+    } else {
+      for (auto& g : golden) if (g.gen == name) ids.push_back(g.stream);
+    }
+    return ids;
+  };
+
+  std::vector<FpJob> jobs;
+  auto stream_seed = [&](unsigned s){
+    splitmix64 seeder(p.seed + s*0x9E3779B97F4A7C15ull);
+    return seeder.next();
+  };
+
+  for_each_fixed_gen(sel, [&](auto tag, const char* name){
+    using RNG = typename decltype(tag)::type;
+    for (unsigned s : streams_for(name)) {
+      const uint64_t seed = stream_seed(s);
+      jobs.push_back({name, s, [seed, p]{
+        return fingerprint_stream([](uint64_t x){ return RNG(x); }, seed, p.outputs, p.chunk);
+      }});
+    }
+  });
+
+  std::unique_ptr<CSimdLib> csimd;
+  const std::vector<unsigned> csimd_streams = streams_for("csimd_universal");
+  if (wants_gen(sel, "csimd") && !csimd_streams.empty()) {
+    if (cmd.csimd_path.empty()) {
+      std::fprintf(stderr, "[warn] --csimd-lib not provided; skipping 'csimd'\n");
+    } else {
+      try {
+        csimd = std::make_unique<CSimdLib>(cmd.csimd_path);
+        CSimdLib* lib = csimd.get();
+        const int algo = cmd.csimd_algo, bw = cmd.csimd_bitwidth;
+        for (unsigned s : csimd_streams) {
+          const uint64_t seed = stream_seed(s);
+          jobs.push_back({"csimd_universal", s, [=]{
+            return fingerprint_stream([&](uint64_t x){ return CSimdLib::Instance(lib, x, algo, bw); }, seed, p.outputs, p.chunk);
+          }});
+        }
+      } catch (const std::exception& e) {
+        std::fprintf(stderr, "[error] csimd: %s\n", e.what());
+      }
+    }
+  }
+
+  std::vector<FpStream> results(jobs.size());
+  std::atomic<size_t> next{0};
+  auto worker = [&]{
+    for (size_t j; (j = next.fetch_add(1)) < jobs.size(); ) {
+      ScopedTimer t;
+      results[j].gen = jobs[j].gen;
+      results[j].stream = jobs[j].stream;
+      results[j].chunks = jobs[j].run();
+      results[j].secs = t.elapsed_sec();
+    }
+  };
+  std::vector<std::thread> ts;
+  const unsigned nthreads = (unsigned)std::min<size_t>(cmd.threads, std::max<size_t>(jobs.size(), 1));
+  for (unsigned t=0;t<nthreads;++t) ts.emplace_back(worker);
+  for (auto& th : ts) th.join();
+
+  print_fp_table(results);
+
+  int rc = 0;
+  if (!cmd.fp_golden.empty()) {
+    if (write_fp_golden(cmd.fp_golden, p, results)) {
+      std::fprintf(stderr, "[info] wrote golden: %s\n", cmd.fp_golden.c_str());
+    } else {
+      std::fprintf(stderr, "[warn] failed to write golden: %s\n", cmd.fp_golden.c_str());
+      rc = 1;
+    }
+  }
+
+  if (verify) {
+    size_t ok = 0, bad = 0, missing = 0;
+    for (auto& g : golden) {
+      auto it = std::find_if(results.begin(), results.end(), [&](const FpStream& r){
+        return r.gen == g.gen && r.stream == g.stream;
+      });
+      if (it == results.end()) {
+        ++missing;
+        std::printf("MISSING  %s stream %u: in golden file but not recomputed\n", g.gen.c_str(), g.stream);
+        continue;
+      }
+      const size_t n = std::max(g.chunks.size(), it->chunks.size());
+      size_t k = 0;
+      for (; k<n; ++k) {
+        if (k >= g.chunks.size() || k >= it->chunks.size()) break;
+        if (g.chunks[k].count != it->chunks[k].count || g.chunks[k].hash != it->chunks[k].hash) break;
+      }
+      if (k == n) { ++ok; continue; }
+      ++bad;
+      const unsigned long long first = (unsigned long long)k * p.chunk;
+      const unsigned long long last  = std::min<unsigned long long>(first + p.chunk, p.outputs) - 1;
+      std::printf("MISMATCH %s stream %u: first divergent chunk %zu (outputs %llu..%llu)\n",
+        g.gen.c_str(), g.stream, k, first, last);
+    }
+    std::printf("verify: %zu stream(s) match, %zu mismatch, %zu missing\n", ok, bad, missing);
+    if (ok + bad == 0) std::fprintf(stderr, "[error] no streams compared\n");
+    if (bad || missing || ok + bad == 0) rc = 1;
+  }
+  return rc;
+}
+
+// ---- workload mode ----------------------------------------------------------
+
+struct WorkloadResult {
+  std::string gen;
+  std::string workload;
+  unsigned threads = 1;
+  uint64_t items = 0;   // elements / samples / steps processed
+  uint64_t draws = 0;   // u64 draws consumed (rejections not counted)
+  double secs = 0.0;    // hot-loop time of the slowest thread
+  double raw_ns = 0.0;  // single-thread next_u64 cost of this generator
+  double check = 0.0;   // sanity value; ~1.0 except pi (~3.1416)
+};
+
+struct WlOut {
+  uint64_t items = 0;
+  uint64_t draws = 0;
+  double secs = 0.0;
+  double check = 0.0;
+};
+
+// Each thread gets its own generator (seeded like the bench threads) and works
+// on its own 1/T share; setup is done outside the timed region.
+template <typename Make, typename Kernel>
+static WorkloadResult run_workload(const std::string& gen, const char* wl, Make& make, const Cmd& cmd,
+                                   unsigned threads, Kernel&& kernel) {
+  const uint64_t share = cmd.wl_size / threads;
+  std::vector<WlOut> outs(threads);
+  std::vector<std::thread> ts;
+  for (unsigned t=0;t<threads;++t) {
+    ts.emplace_back([&, t]{
+      splitmix64 seeder(cmd.seed + t*0x9E3779B97F4A7C15ull);
+      auto rng = make(seeder.next());
+      outs[t] = kernel(rng, share);
+    });
+  }
+  for (auto& th : ts) th.join();
+
+  WorkloadResult r; r.gen = gen; r.workload = wl; r.threads = threads;
+  for (auto& o : outs) {
+    r.items += o.items;
+    r.draws += o.draws;
+    r.secs = std::max(r.secs, o.secs);
+    r.check += o.check / threads;
+  }
+  return r;
+}
+
+template <typename Make>
+static double raw_ns_per_u64(Make& make, const Cmd& cmd) {
+  splitmix64 seeder(cmd.seed);
+  auto rng = make(seeder.next());
+  uint64_t acc = 0;
+  ScopedTimer t;
+  for (uint64_t i=0;i<cmd.wl_size;++i) acc ^= rng.next_u64();
+  const double secs = t.elapsed_sec();
+  volatile uint64_t sink = acc; (void)sink;
+  return secs * 1e9 / (double)std::max<uint64_t>(cmd.wl_size, 1);
+}
+
+template <typename Make>
+static void run_workloads(const std::string& gen, Make& make, const Cmd& cmd, std::vector<WorkloadResult>& out) {
+  static constexpr uint64_t kReservoir = 1024;
+  static constexpr uint64_t kAliasCats = 1024;
+  static constexpr uint64_t kWalkSteps = 4096;
+
+  const double raw_ns = raw_ns_per_u64(make, cmd);
+
+  std::vector<unsigned> tcounts{1};
+  if (cmd.threads > 1) tcounts.push_back(cmd.threads);
+
+  for (unsigned T : tcounts) {
+    const size_t first = out.size();
+
+    out.push_back(run_workload(gen, "shuffle", make, cmd, T, [](auto& rng, uint64_t n){
+      std::vector<uint32_t> a(n);
+      std::iota(a.begin(), a.end(), 0u);
+      WlOut o; o.items = n;
+      ScopedTimer t;
+      o.draws = shuffle_batched(rng, a.data(), n);
+      o.secs = t.elapsed_sec();
+      for (uint64_t i=0;i<n;++i) o.check += (a[i] == i); // expected fixed points: 1
+      return o;
+    }));
+
+    out.push_back(run_workload(gen, "reservoir", make, cmd, T, [](auto& rng, uint64_t n){
+      std::vector<uint32_t> in(n);
+      std::iota(in.begin(), in.end(), 0u);
+      std::vector<uint32_t> res(kReservoir);
+      WlOut o; o.items = n; o.draws = n > kReservoir ? n - kReservoir : 0;
+      ScopedTimer t;
+      reservoir_sample(rng, in.data(), n, res.data(), kReservoir);
+      o.secs = t.elapsed_sec();
+      // with n < kReservoir only the first n slots are filled
+      const uint64_t k = std::min(n, kReservoir);
+      double sum = 0.0;
+      for (uint64_t j=0;j<k;++j) sum += res[j];
+      o.check = n > 1 ? (sum / (double)k) / ((double)(n - 1) / 2.0) : 0.0;
+      return o;
+    }));
+
+    out.push_back(run_workload(gen, "alias", make, cmd, T, [](auto& rng, uint64_t n){
+      std::vector<double> w(kAliasCats);
+      double wsum = 0.0, expect = 0.0;
+      for (uint64_t i=0;i<kAliasCats;++i) { w[i] = (double)(i + 1); wsum += w[i]; expect += (double)i * w[i]; }
+      expect /= wsum;
+      AliasTable table(w);
+      WlOut o; o.items = n; o.draws = 2 * n;
+      uint64_t sum = 0;
+      ScopedTimer t;
+      for (uint64_t i=0;i<n;++i) sum += table.sample(rng);
+      o.secs = t.elapsed_sec();
+      o.check = n ? ((double)sum / (double)n) / expect : 0.0;
+      return o;
+    }));
+
+    out.push_back(run_workload(gen, "pi", make, cmd, T, [](auto& rng, uint64_t n){
+      WlOut o; o.items = n; o.draws = 2 * n;
+      ScopedTimer t;
+      const uint64_t hits = monte_carlo_pi_hits(rng, n);
+      o.secs = t.elapsed_sec();
+      o.check = n ? 4.0 * (double)hits / (double)n : 0.0;
+      return o;
+    }));
+
+    out.push_back(run_workload(gen, "walk1d", make, cmd, T, [](auto& rng, uint64_t n){
+      const uint64_t walkers = std::max<uint64_t>(n / kWalkSteps, 1);
+      WlOut o; o.items = walkers * kWalkSteps; o.draws = o.items / 64;
+      double msd = 0.0;
+      ScopedTimer t;
+      for (uint64_t w=0;w<walkers;++w) {
+        const int64_t x = random_walk_1d(rng, kWalkSteps);
+        msd += (double)(x * x);
+      }
+      o.secs = t.elapsed_sec();
+      o.check = msd / (double)walkers / (double)kWalkSteps; // E[x^2] = steps
+      return o;
+    }));
+
+    out.push_back(run_workload(gen, "walk2d", make, cmd, T, [](auto& rng, uint64_t n){
+      const uint64_t walkers = std::max<uint64_t>(n / kWalkSteps, 1);
+      WlOut o; o.items = walkers * kWalkSteps; o.draws = o.items / 32;
+      double msd = 0.0;
+      ScopedTimer t;
+      for (uint64_t w=0;w<walkers;++w) msd += (double)random_walk_2d(rng, kWalkSteps);
+      o.secs = t.elapsed_sec();
+      o.check = msd / (double)walkers / (double)kWalkSteps; // E[r^2] = steps
+      return o;
+    }));
+
+    for (size_t i=first;i<out.size();++i) out[i].raw_ns = raw_ns;
+  }
+}
+
+static void print_workload_table(const std::vector<WorkloadResult>& W) {
+  auto w = [](int n){ return std::setw(n); };
+  std::cout << std::left
+    << w(20) << "generator"
+    << w(12) << "workload"
+    << w(8)  << "threads"
+    << w(12) << "time(ms)"
+    << w(16) << "items/s"
+    << w(12) << "raw ns/u64"
+    << w(8)  << "gen%"
+    << w(10) << "check"
+    << "\n";
+  std::cout << std::string(20+12+8+12+16+12+8+10, '-') << "\n";
+  for (auto& r : W) {
+    std::ostringstream rate;
+    rate << std::fixed << std::setprecision(2) << (r.secs > 0.0 ? (double)r.items / r.secs / 1e6 : 0.0) << " M/s";
+    // share of the hot loop the generator alone would account for
+    const double gen_pct = r.secs > 0.0 ? 100.0 * (double)r.draws * r.raw_ns / (r.secs * 1e9 * r.threads) : 0.0;
+    std::cout << std::left << std::fixed
+      << w(20) << r.gen
+      << w(12) << r.workload
+      << w(8)  << r.threads
+      << w(12) << std::setprecision(2) << r.secs * 1e3
+      << w(16) << rate.str()
+      << w(12) << std::setprecision(3) << r.raw_ns
+      << w(8)  << std::setprecision(0) << gen_pct
+      << w(10) << std::setprecision(4) << r.check
+      << "\n";
+  }
+}
+
+static int run_workload_mode(const Cmd& cmd) {
+  std::vector<WorkloadResult> W;
+
+  for_each_fixed_gen(cmd, [&](auto tag, const char* name){
+    using RNG = typename decltype(tag)::type;
+    auto make = [](uint64_t s){ return RNG(s); };
+    run_workloads(name, make, cmd, W);
+  });
+  if (wants_gen(cmd, "csimd")) {
+    if (cmd.csimd_path.empty()) {
+      std::fprintf(stderr, "[warn] --csimd-lib not provided; skipping 'csimd'\n");
+    } else {
+      try {
+        CSimdLib lib(cmd.csimd_path);
+        auto make = [&](uint64_t s){ return CSimdLib::Instance(&lib, s, cmd.csimd_algo, cmd.csimd_bitwidth); };
+        run_workloads("csimd_universal", make, cmd, W);
+      } catch (const std::exception& e) {
+        std::fprintf(stderr, "[error] csimd: %s\n", e.what());
+      }
+    }
+  }
+
+  print_workload_table(W);
+
+  if (!cmd.csv_path.empty()) {
+    CsvWriter w(cmd.csv_path);
+    if (w) {
+      w.header({"generator","workload","threads","items","draws","secs","raw_ns_per_u64","check"});
+      for (auto& r : W) {
+        w.write({
+          r.gen,
+          r.workload,
+          std::to_string(r.threads),
+          std::to_string(r.items),
+          std::to_string(r.draws),
+          std::to_string(r.secs),
+          std::to_string(r.raw_ns),
+          std::to_string(r.check)
+        });
+      }
+      w.flush();
+      std::fprintf(stderr, "[info] wrote CSV: %s\n", cmd.csv_path.c_str());
+    } else {
+      std::fprintf(stderr, "[warn] failed to open CSV for write: %s\n", cmd.csv_path.c_str());
+    }
+  }
+  return 0;
+}
+
+// ---- contention mode --------------------------------------------------------
+
+struct ContentionResult {
+  std::string strategy;
+  unsigned threads = 1;
+  uint64_t ops = 0;
+  double secs = 0.0;   // wall time, all threads
+  double p50_ns = 0.0; // typical per-call latency, from timed batches of 8
+  double p99_ns = 0.0; // per-call tail latency, from single timed calls
+  double p999_ns = 0.0;
+};
+
+// Threads start together on a flag. Every 256 calls two latency samples are
+// taken, each with the calibrated cost of an empty timer pair (median of
+// 1024, measured per thread) subtracted:
+//  - p50: a batch of 8 back-to-back calls, divided by 8, so clock resolution
+//    does not dominate the typical case;
+//  - p99/p99.9: one call timed on its own, so a single call stalled behind a
+//    preempted lock holder shows up at full size instead of averaged away.
+template <typename Shared>
+static ContentionResult run_contention(const char* name, const Cmd& cmd, unsigned threads, uint64_t per_thread) {
+  static constexpr uint64_t kSampleEvery = 256;
+  static constexpr uint64_t kBatch = 8;
+  Shared g(cmd.seed);
+  std::atomic<bool> go{false};
+  std::atomic<unsigned> ready{0};
+  std::atomic<uint64_t> sink{0};
+  std::vector<std::vector<float>> lat_batch(threads), lat_single(threads);
+
+  auto elapsed_ns = [](clock_type::time_point t0, clock_type::time_point t1){
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  };
+
+  std::vector<std::thread> ts;
+  for (unsigned t=0;t<threads;++t) {
+    ts.emplace_back([&, t]{
+      auto& B = lat_batch[t];
+      auto& S = lat_single[t];
+      B.reserve(per_thread / kSampleEvery + 1);
+      S.reserve(per_thread / kSampleEvery + 1);
+
+      std::vector<double> empty(1024);
+      for (auto& e : empty) {
+        auto t0 = clock_type::now();
+        e = elapsed_ns(t0, clock_type::now());
+      }
+      std::nth_element(empty.begin(), empty.begin() + empty.size()/2, empty.end());
+      const double overhead = empty[empty.size()/2];
+
+      uint64_t acc = 0;
+      ready.fetch_add(1);
+      while (!go.load(std::memory_order_acquire)) cpu_relax();
+      uint64_t i = 0;
+      while (i < per_thread) {
+        const uint64_t phase = i % kSampleEvery;
+        if (phase == 0 && i + kBatch <= per_thread) {
+          auto t0 = clock_type::now();
+          for (uint64_t b=0;b<kBatch;++b) acc ^= g.next_u64();
+          const double ns = elapsed_ns(t0, clock_type::now()) - overhead;
+          B.push_back((float)(std::max(ns, 0.0) / kBatch));
+          i += kBatch;
+        } else if (phase == kSampleEvery / 2) {
+          auto t0 = clock_type::now();
+          acc ^= g.next_u64();
+          const double ns = elapsed_ns(t0, clock_type::now()) - overhead;
+          S.push_back((float)std::max(ns, 0.0));
+          ++i;
+        } else {
+          acc ^= g.next_u64();
+          ++i;
+        }
+      }
+      sink.fetch_xor(acc);
+    });
+  }
+  while (ready.load() < threads) std::this_thread::yield();
+  ScopedTimer timer;
+  go.store(true, std::memory_order_release);
+  for (auto& th : ts) th.join();
+
+  ContentionResult r; r.strategy = name; r.threads = threads;
+  r.secs = timer.elapsed_sec();
+  r.ops = per_thread * threads;
+
+  auto pct = [](std::vector<std::vector<float>>& per_thread_samples, double q)->double{
+    std::vector<float> all;
+    for (auto& L : per_thread_samples) all.insert(all.end(), L.begin(), L.end());
+    if (all.empty()) return 0.0;
+    size_t k = std::min(all.size() - 1, (size_t)(q * (double)all.size()));
+    std::nth_element(all.begin(), all.begin() + k, all.end());
+    return all[k];
+  };
+  r.p50_ns = pct(lat_batch, 0.50);
+  r.p99_ns = pct(lat_single, 0.99);
+  r.p999_ns = pct(lat_single, 0.999);
+  return r;
+}
+
+static void print_contention_table(const std::vector<ContentionResult>& C) {
+  auto w = [](int n){ return std::setw(n); };
+  std::cout << std::left
+    << w(24) << "strategy"
+    << w(8)  << "threads"
+    << w(16) << "ops/s"
+    << w(10) << "p50(ns)"
+    << w(10) << "p99(ns)"
+    << w(10) << "p99.9(ns)"
+    << "\n";
+  std::cout << std::string(24+8+16+10+10+10, '-') << "\n";
+  for (auto& r : C) {
+    std::ostringstream rate;
+    rate << std::fixed << std::setprecision(2) << (r.secs > 0.0 ? (double)r.ops / r.secs / 1e6 : 0.0) << " M/s";
+    std::cout << std::left << std::fixed << std::setprecision(1)
+      << w(24) << r.strategy
+      << w(8)  << r.threads
+      << w(16) << rate.str()
+      << w(10) << r.p50_ns
+      << w(10) << r.p99_ns
+      << w(10) << r.p999_ns
+      << "\n";
+  }
+}
+
+static int run_contention_mode(const Cmd& cmd) {
+  std::vector<unsigned> tcounts;
+  for (unsigned t=1;t<cmd.threads;t*=2) tcounts.push_back(t);
+  tcounts.push_back(cmd.threads);
+  const uint64_t per_thread = cmd.total / cmd.threads;
+
+  std::vector<ContentionResult> C;
+  for (unsigned T : tcounts) {
+    C.push_back(run_contention<shared_mutex_xoroshiro>("mutex_xoroshiro128pp", cmd, T, per_thread));
+    C.push_back(run_contention<shared_spin_xoroshiro>("spin_xoroshiro128pp", cmd, T, per_thread));
+    C.push_back(run_contention<shared_atomic_splitmix>("atomic_splitmix64", cmd, T, per_thread));
+    C.push_back(run_contention<thread_local_xoroshiro>("thread_local_xoroshiro", cmd, T, per_thread));
+    C.push_back(run_contention<sharded_xoroshiro>("sharded_xoroshiro", cmd, T, per_thread));
+  }
+
+  print_contention_table(C);
+
+  if (!cmd.csv_path.empty()) {
+    CsvWriter w(cmd.csv_path);
+    if (w) {
+      w.header({"strategy","threads","ops","secs","ops_per_s","p50_ns","p99_ns","p999_ns"});
+      for (auto& r : C) {
+        w.write({
+          r.strategy,
+          std::to_string(r.threads),
+          std::to_string(r.ops),
+          std::to_string(r.secs),
+          std::to_string(r.secs > 0.0 ? (double)r.ops / r.secs : 0.0),
+          std::to_string(r.p50_ns),
+          std::to_string(r.p99_ns),
+          std::to_string(r.p999_ns)
+        });
+      }
+      w.flush();
+      std::fprintf(stderr, "[info] wrote CSV: %s\n", cmd.csv_path.c_str());
+    } else {
+      std::fprintf(stderr, "[warn] failed to open CSV for write: %s\n", cmd.csv_path.c_str());
+    }
+  }
+  return 0;
+}
+
+// ---- process isolation ------------------------------------------------------
+
+struct BenchJob {
+  std::string name;
+  std::function<BenchResult(const Cmd&)> run; // empty name in the result = failed
+};
+
+static std::vector<BenchJob> bench_jobs(const Cmd& cmd) {
+  std::vector<BenchJob> jobs;
+  for_each_fixed_gen(cmd, [&](auto tag, const char* name){
+    using RNG = typename decltype(tag)::type;
+    jobs.push_back({name, [name](const Cmd& c){ return run_bench_fixed<RNG>(name, c); }});
+  });
+  if (wants_gen(cmd, "csimd")) {
+    if (cmd.csimd_path.empty()) {
+      std::fprintf(stderr, "[warn] --csimd-lib not provided; skipping 'csimd'\n");
+    } else {
+      jobs.push_back({"csimd_universal", [](const Cmd& c){
+        try {
+          return run_bench_csimd("csimd_universal", c, c.csimd_path, c.csimd_algo, c.csimd_bitwidth);
+        } catch (const std::exception& e) {
+          std::fprintf(stderr, "[error] csimd: %s\n", e.what());
+          return BenchResult{};
+        }
+      }});
+    }
+  }
+  return jobs;
+}
+
+static std::string pack_result(const BenchResult& r) {
+  std::ostringstream ss;
+  ss << std::setprecision(17)
+     << r.name << '\n'
+     << r.total_u64 << ' ' << r.secs_u64 << ' ' << r.ops_per_s_u64 << ' '
+     << r.total_f64 << ' ' << r.secs_f64 << ' ' << r.ops_per_s_f64 << ' '
+     << r.mean_f64 << ' ' << r.var_f64 << ' ' << r.chi2_bytes << ' ' << r.threads << '\n';
+  return ss.str();
+}
+
+static bool unpack_result(const std::string& s, BenchResult& r) {
+  std::istringstream ss(s);
+  std::getline(ss, r.name);
+  ss >> r.total_u64 >> r.secs_u64 >> r.ops_per_s_u64
+     >> r.total_f64 >> r.secs_f64 >> r.ops_per_s_f64
+     >> r.mean_f64 >> r.var_f64 >> r.chi2_bytes >> r.threads;
+  return !ss.fail() && !r.name.empty();
+}
+
+static std::vector<BenchResult> run_bench_isolated(const Cmd& cmd, const std::vector<BenchJob>& jobs) {
+  std::vector<IsolatedJob> iso;
+  for (auto& j : jobs) {
+    // a pinned child defaults to one thread per CPU in its group
+    iso.push_back({j.name, [&j, &cmd](const std::vector<unsigned>& cpus){
+      Cmd c = cmd;
+      if (!cmd.threads_given && !cpus.empty()) c.threads = (unsigned)cpus.size();
+      BenchResult r = j.run(c);
+      return r.name.empty() ? std::string() : pack_result(r);
+    }});
+  }
+
+  unsigned slots = std::max(1u, std::min<unsigned>(cmd.jobs, (unsigned)jobs.size()));
+  if (!cmd.cpus.empty()) {
+    slots = std::min<unsigned>(slots, (unsigned)cmd.cpus.size());
+    const size_t per_group = cmd.cpus.size() / slots;
+    if (cmd.threads_given && cmd.threads > per_group) {
+      std::fprintf(stderr, "[warn] --threads %u exceeds the %zu CPU(s) per job; threads will share cores\n",
+                   cmd.threads, per_group);
+    }
+  }
+
+  ScopedTimer t;
+  auto payloads = run_isolated(iso, slots, cmd.cpus);
+  std::fprintf(stderr, "[info] %zu isolated job(s), %u at a time, in %.2f s\n", jobs.size(), slots, t.elapsed_sec());
+
+  std::vector<BenchResult> results;
+  for (size_t j=0;j<payloads.size();++j) {
+    if (!payloads[j]) continue;
+    BenchResult r;
+    if (unpack_result(*payloads[j], r)) results.push_back(std::move(r));
+    else std::fprintf(stderr, "[error] %s: malformed result from child\n", jobs[j].name.c_str());
+  }
+  return results;
+}
+
 static void print_table(const std::vector<BenchResult>& R) {
   auto w = [](int n){ return std::setw(n); };
   std::cout << std::left
@@ -319,57 +1113,27 @@ static void print_table(const std::vector<BenchResult>& R) {
 int main(int argc, char** argv) {
   Cmd cmd = parse(argc, argv);
 
-  // default list:
-  if (cmd.gens.empty()) {
-    cmd.gens = {
-      "std_mt19937",
-      "std_mt19937_64",
-      "std_minstd",
-      "ranlux48",
-      "xoroshiro128pp",
-//      "xoshiro256ss",
-      "pcg32",
-      "csimd"
-    };
-  }
+  if (cmd.gens.empty()) cmd.gens = all_gen_tags();
 
-  std::vector<BenchResult> results;
-
-  auto wants = [&](const char* tag){
-    return std::find(cmd.gens.begin(), cmd.gens.end(), std::string(tag)) != cmd.gens.end();
-  };
-
-  if (wants("std_mt19937")) {
-    results.push_back(run_bench_fixed<std_mt19937>("std_mt19937", cmd));
-  }
-  if (wants("std_mt19937_64")) {
-    results.push_back(run_bench_fixed<std_mt19937_64>("std_mt19937_64", cmd));
-  }
-  if (wants("std_minstd")) {
-    results.push_back(run_bench_fixed<std_minstd_rand>("minstd_rand", cmd));
-  }
-  if (wants("ranlux48")) {
-    results.push_back(run_bench_fixed<std_ranlux48>("ranlux48", cmd));
+  if (cmd.fp_outputs || !cmd.fp_verify.empty()) {
+    return run_fingerprint(cmd);
   }
-  if (wants("xoroshiro128pp")) {
-    results.push_back(run_bench_fixed<xoroshiro128pp>("xoroshiro128pp", cmd));
+  if (cmd.workloads) {
+    return run_workload_mode(cmd);
   }
-//  if (wants("xoshiro256ss")) {
-//    results.push_back(run_bench_fixed<xoshiro256ss>("xoshiro256ss", cmd));
-//  }
-  if (wants("pcg32")) {
-    results.push_back(run_bench_fixed<pcg32>("pcg32", cmd));
+  if (cmd.contention) {
+    return run_contention_mode(cmd);
   }
-  if (wants("csimd")) {
-    if (cmd.csimd_path.empty()) {
-      std::fprintf(stderr, "[warn] --csimd-lib not provided; skipping 'csimd'\n");
-    } else {
-      try {
-        auto r = run_bench_csimd("csimd_universal", cmd, cmd.csimd_path, cmd.csimd_algo, cmd.csimd_bitwidth);
-        results.push_back(std::move(r));
-      } catch (const std::exception& e) {
-        std::fprintf(stderr, "[error] csimd: %s\n", e.what());
-      }
+
+  std::vector<BenchResult> results;
+  const std::vector<BenchJob> jobs = bench_jobs(cmd);
+
+  if (cmd.isolate) {
+    results = run_bench_isolated(cmd, jobs);
+  } else {
+    for (auto& j : jobs) {
+      BenchResult r = j.run(cmd);
+      if (!r.name.empty()) results.push_back(std::move(r));
     }
   }
 